@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <pluginplay/pluginplay.hpp>
+#include <simde/simde.hpp>
+#include <string>
+
+namespace nwchemex {
+
+/** @brief Bytes needed to hold the full ERI4 tensor plus the D, F, J, and K
+ *         matrices.
+ *
+ *  Estimates too large for std::size_t are clamped to its maximum.
+ */
+std::size_t in_core_jk_memory(std::size_t n_aos);
+
+/** @brief Bytes needed for the transformed ERI3, the fitting metric, and the
+ *         D, F, J, and K matrices.
+ *
+ *  Estimates too large for std::size_t are clamped to its maximum.
+ */
+std::size_t density_fitted_jk_memory(std::size_t n_aos, std::size_t n_aux);
+
+/** @brief Wires the SCF J and K builders from a memory budget.
+ *
+ *  All of the SCF drivers build J and K through the "Fock Matrix" module, so
+ *  this rewires its "J Builder" and "K Builder" submodules once, before any
+ *  driver runs, rather than each driver rewiring copies of its submodules on
+ *  every call. The exact in-core algorithm ("CanJK") is used whenever its
+ *  estimated footprint fits in @p max_memory. Density fitting ("DFJK") changes
+ *  the energy, so it is only considered when @p allow_density_fitting is true,
+ *  and then only if "DFJK" has been given a "Fitting Basis". The choice is
+ *  logged, including whether it is approximate.
+ *
+ *  No out-of-core or direct J/K builders exist yet; when they do, they belong
+ *  after the in-core algorithm and before density fitting.
+ *
+ *  @param[in] mm The ModuleManager whose "Fock Matrix" module is rewired.
+ *  @param[in] aos The AO basis set the SCF will be run in.
+ *  @param[in] max_memory The memory budget, in bytes.
+ *  @param[in] allow_density_fitting Whether the approximate density-fitted
+ *                                   algorithm may be selected. Defaults to
+ *                                   false.
+ *
+ *  @return The key of the module now used for J and K.
+ *
+ *  @throw std::runtime_error if no allowed algorithm fits in @p max_memory, or
+ *                            if density fitting is needed but "DFJK" has no
+ *                            fitting basis. These are detected before
+ *                            anything is rewired. Strong throw guarantee.
+ *  @throw ??? if rewiring "J Builder" or "K Builder" throws. Weak throw
+ *             guarantee: J and K may then be built by different modules.
+ */
+std::string select_jk_algorithm(pluginplay::ModuleManager& mm,
+                                const simde::type::ao_space& aos,
+                                std::size_t max_memory,
+                                bool allow_density_fitting = false);
+
+} // namespace nwchemex
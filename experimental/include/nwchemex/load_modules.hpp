@@ -16,6 +16,7 @@
 
 #pragma once
 #include <pluginplay/pluginplay.hpp>
+#include <string>
 
 namespace nwchemex {
 
@@ -29,4 +30,26 @@ namespace nwchemex {
  */
 DECLARE_PLUGIN(nwchemex);
 
+/** @brief Switches the SCF drivers to the SAD guess for a basis set.
+ *
+ *  The core Hamiltonian guess is the default. This points "SCF Wavefunction"
+ *  and "SCF Density Driver" at "SADGuess", and "SADDensity" at ChemCache's
+ *  "<basis_name> atomic dm" module, which is only run, and thus only loaded,
+ *  the first time a guess needs it. The atomic densities must match the basis
+ *  set the SCF is run in, so call this again when changing basis sets.
+ *  ChemCache currently only provides atomic densities for STO-3G.
+ *
+ *  @param[in] mm The ModuleManager whose SCF modules are rewired.
+ *  @param[in] basis_name The ChemCache name of the basis set, e.g., "sto-3g".
+ *
+ *  @throw std::out_of_range if ChemCache has no atomic densities for
+ *                           @p basis_name. This is checked before anything is
+ *                           rewired. Strong throw guarantee.
+ *  @throw ??? if rewiring any of the three modules throws. Weak throw
+ *             guarantee: the modules rewired before the error keep their new
+ *             submodules.
+ */
+void use_sad_guess(pluginplay::ModuleManager& mm,
+                   const std::string& basis_name);
+
 } // namespace nwchemex
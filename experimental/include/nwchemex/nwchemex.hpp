@@ -15,5 +15,6 @@
  */
 
 #pragma once
+#include <nwchemex/jk_selection.hpp>
 #include <nwchemex/load_modules.hpp>
 #include <simde/simde.hpp>
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <simde/simde.hpp>
+#include <string>
+#include <vector>
+
+namespace nwchemex {
+
+/** @brief One operation of an Abelian point group.
+ *
+ *  Every operation of D2h and its subgroups is diagonal in the symmetry frame,
+ *  so it is stored as the sign it applies to each of x, y, and z.
+ */
+struct symmetry_operation {
+    /// Schoenflies label, e.g., "E", "C2(z)", "i", or "sigma(xy)"
+    std::string name;
+
+    /// Sign applied to the x, y, and z coordinates in the symmetry frame
+    std::array<int, 3> signs;
+
+    /// atom_map[i] is the index of the atom that atom i is mapped onto
+    std::vector<std::size_t> atom_map;
+};
+
+/** @brief The largest Abelian point group of a molecule and its frame.
+ *
+ *  Coordinates in the symmetry frame are obtained from input coordinates r as
+ *  axes * (r - origin), i.e., the rows of @c axes are the frame's x, y, and z
+ *  axes expressed in input coordinates. For groups with a unique C2 axis that
+ *  axis is z; for Cs the mirror plane is xy.
+ */
+struct point_group {
+    /// Schoenflies symbol: C1, Cs, Ci, C2, C2v, C2h, D2, or D2h
+    std::string name;
+
+    /// Center of nuclear charge, in input coordinates
+    std::array<double, 3> origin;
+
+    /// Rows are the symmetry frame axes, in input coordinates
+    std::array<std::array<double, 3>, 3> axes;
+
+    /// The group's operations, starting with the identity
+    std::vector<symmetry_operation> operations;
+
+    /// The number of operations in the group
+    std::size_t order() const noexcept { return operations.size(); }
+};
+
+/** @brief Finds the largest Abelian point group of @p sys's nuclei.
+ *
+ *  Atoms are considered equivalent if they have the same atomic number, which
+ *  is what the electronic Hamiltonian and the basis set depend on. The search
+ *  tries the principal axes of the nuclear charge distribution and, when those
+ *  are degenerate, additional frames aligned with the atoms, keeping the frame
+ *  with the most operations. Non-Abelian groups are reported as an Abelian
+ *  subgroup, e.g., Cs for NH3 (C3v) and D2h for benzene (D6h).
+ *
+ *  @param[in] sys The chemical system whose nuclei are analyzed.
+ *  @param[in] tolerance Maximum distance, in bohr, between an atom's image and
+ *                       its partner. Defaults to 1.0E-4.
+ *
+ *  @return The detected group, including the mapping of atoms under each
+ *          operation.
+ *
+ *  @throw std::bad_alloc if there is insufficient memory. Strong throw
+ *                        guarantee.
+ */
+point_group detect_point_group(const simde::type::chemical_system& sys,
+                               double tolerance = 1.0e-4);
+
+} // namespace nwchemex
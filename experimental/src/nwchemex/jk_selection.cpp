@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nwchemex/jk_selection.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace nwchemex {
+namespace {
+
+// Bytes for @p n_doubles doubles, clamped to the largest std::size_t rather
+// than wrapping, so huge basis sets never look like they fit
+std::size_t bytes_for(long double n_doubles) {
+    constexpr auto max = std::numeric_limits<std::size_t>::max();
+    const auto bytes   = n_doubles * sizeof(double);
+    if(bytes >= static_cast<long double>(max)) return max;
+    return static_cast<std::size_t>(bytes);
+}
+
+void use_jk_builder(pluginplay::ModuleManager& mm, const std::string& key,
+                    const std::string& description, std::size_t memory,
+                    std::size_t max_memory) {
+    mm.change_submod("Fock Matrix", "J Builder", key);
+    mm.change_submod("Fock Matrix", "K Builder", key);
+    mm.get_runtime().logger().info(
+      "Using " + description + " J/K (" + key + "), estimated to need " +
+      std::to_string(memory) + " of " + std::to_string(max_memory) + " bytes");
+}
+
+} // namespace
+
+std::size_t in_core_jk_memory(std::size_t n_aos) {
+    const auto n2 = static_cast<long double>(n_aos) * n_aos;
+    return bytes_for(n2 * n2 + 4 * n2);
+}
+
+std::size_t density_fitted_jk_memory(std::size_t n_aos, std::size_t n_aux) {
+    const auto n2  = static_cast<long double>(n_aos) * n_aos;
+    const auto aux = static_cast<long double>(n_aux);
+    return bytes_for(aux * n2 + aux * aux + 4 * n2);
+}
+
+std::string select_jk_algorithm(pluginplay::ModuleManager& mm,
+                                const simde::type::ao_space& aos,
+                                std::size_t max_memory,
+                                bool allow_density_fitting) {
+    const auto n_aos   = aos.basis_set().n_aos();
+    const auto in_core = in_core_jk_memory(n_aos);
+    if(in_core <= max_memory) {
+        use_jk_builder(mm, "CanJK", "exact in-core", in_core, max_memory);
+        return "CanJK";
+    }
+
+    std::string msg = "The in-core J/K algorithm needs an estimated " +
+                      std::to_string(in_core) + " bytes, which exceeds the " +
+                      std::to_string(max_memory) + " byte budget";
+    if(!allow_density_fitting)
+        throw std::runtime_error(msg + ". Density fitting was not allowed.");
+
+    const auto& fitting = mm.at("DFJK").inputs().at("Fitting Basis");
+    if(!fitting.has_value())
+        throw std::runtime_error(msg + ", and DFJK has no fitting basis.");
+
+    const auto n_aux =
+      fitting.value<const simde::type::ao_space&>().basis_set().n_aos();
+    const auto density_fitted = density_fitted_jk_memory(n_aos, n_aux);
+    if(density_fitted > max_memory)
+        throw std::runtime_error(msg + ", as does density fitting's estimate "
+                                       "of " +
+                                 std::to_string(density_fitted) + " bytes.");
+
+    use_jk_builder(mm, "DFJK", "approximate density-fitted", density_fitted,
+                   max_memory);
+    return "DFJK";
+}
+
+} // namespace nwchemex
@@ -21,6 +21,7 @@
 #include <integrals/integrals.hpp>
 // #include <mp2/mp2.hpp>
 #include <scf/scf.hpp>
+#include <stdexcept>
 
 namespace {
 
@@ -75,6 +76,17 @@ void set_scf_default_modules(pluginplay::ModuleManager& mm) {
 
 namespace nwchemex {
 
+void use_sad_guess(pluginplay::ModuleManager& mm,
+                   const std::string& basis_name) {
+    const auto key = basis_name + " atomic dm";
+    if(!mm.count(key))
+        throw std::out_of_range("No SAD atomic densities for basis set: " +
+                                basis_name);
+    mm.change_submod("SADDensity", "Atomic Density", key);
+    mm.change_submod("SCF Wavefunction", "Guess", "SADGuess");
+    mm.change_submod("SCF Density Driver", "Guess", "SADGuess");
+}
+
 void set_defaults(pluginplay::ModuleManager& mm) {
     mm.change_submod("SCF Energy", "System Hamiltonian", "SystemHamiltonian");
     mm.change_submod("SCF Energy", "Reference Wave Function",
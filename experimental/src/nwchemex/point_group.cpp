@@ -0,0 +1,305 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nwchemex/point_group.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace nwchemex {
+namespace {
+
+using vector_t = std::array<double, 3>;
+using matrix_t = std::array<vector_t, 3>;
+
+struct d2h_operation {
+    const char* name;
+    std::array<int, 3> signs;
+};
+
+// The operations of D2h, identity first
+constexpr std::array<d2h_operation, 8> d2h_operations{
+  {{"E", {1, 1, 1}},
+   {"C2(z)", {-1, -1, 1}},
+   {"C2(y)", {-1, 1, -1}},
+   {"C2(x)", {1, -1, -1}},
+   {"i", {-1, -1, -1}},
+   {"sigma(xy)", {1, 1, -1}},
+   {"sigma(xz)", {1, -1, 1}},
+   {"sigma(yz)", {-1, 1, 1}}}};
+
+struct atom_data {
+    std::size_t Z;
+    vector_t r;
+};
+
+double dot(const vector_t& a, const vector_t& b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+vector_t cross(const vector_t& a, const vector_t& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+}
+
+vector_t normalize(vector_t a) {
+    const auto norm = std::sqrt(dot(a, a));
+    for(auto& x : a) x /= norm;
+    return a;
+}
+
+// Eigenvalues and eigenvectors (rows) of a symmetric 3x3 matrix via Jacobi
+std::pair<vector_t, matrix_t> eigen_symmetric(matrix_t a) {
+    matrix_t v{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+    for(std::size_t sweep = 0; sweep < 50; ++sweep) {
+        const auto off = a[0][1] * a[0][1] + a[0][2] * a[0][2] +
+                         a[1][2] * a[1][2];
+        if(off < 1.0e-30) break;
+        for(std::size_t p = 0; p < 2; ++p) {
+            for(std::size_t q = p + 1; q < 3; ++q) {
+                if(std::abs(a[p][q]) < 1.0e-300) continue;
+                const auto theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const auto t     = (theta >= 0.0 ? 1.0 : -1.0) /
+                               (std::abs(theta) + std::sqrt(theta * theta + 1));
+                const auto c     = 1.0 / std::sqrt(t * t + 1.0);
+                const auto s     = t * c;
+                for(std::size_t k = 0; k < 3; ++k) {
+                    const auto akp = a[k][p], akq = a[k][q];
+                    a[k][p]        = c * akp - s * akq;
+                    a[k][q]        = s * akp + c * akq;
+                }
+                for(std::size_t k = 0; k < 3; ++k) {
+                    const auto apk = a[p][k], aqk = a[q][k];
+                    a[p][k]        = c * apk - s * aqk;
+                    a[q][k]        = s * apk + c * aqk;
+                }
+                for(std::size_t k = 0; k < 3; ++k) {
+                    const auto vpk = v[p][k], vqk = v[q][k];
+                    v[p][k]        = c * vpk - s * vqk;
+                    v[q][k]        = s * vpk + c * vqk;
+                }
+            }
+        }
+    }
+    return {{a[0][0], a[1][1], a[2][2]}, v};
+}
+
+// Frame with z along @p z and x along the part of @p x orthogonal to z
+matrix_t frame_from(const vector_t& z, const vector_t& x) {
+    const auto ez = normalize(z);
+    auto ex       = x;
+    const auto xz = dot(x, ez);
+    for(std::size_t k = 0; k < 3; ++k) ex[k] -= xz * ez[k];
+    ex = normalize(ex);
+    return {ex, cross(ez, ex), ez};
+}
+
+// The operations of D2h which map the atoms onto themselves in @p frame
+std::vector<symmetry_operation> find_operations(
+  const std::vector<atom_data>& atoms, const matrix_t& frame, double tol) {
+    std::vector<vector_t> r(atoms.size());
+    for(std::size_t i = 0; i < atoms.size(); ++i)
+        for(std::size_t k = 0; k < 3; ++k) r[i][k] = dot(frame[k], atoms[i].r);
+
+    std::vector<symmetry_operation> rv;
+    for(const auto& op : d2h_operations) {
+        std::vector<std::size_t> atom_map(atoms.size());
+        bool is_symmetry = true;
+        for(std::size_t i = 0; i < atoms.size() && is_symmetry; ++i) {
+            is_symmetry = false;
+            for(std::size_t j = 0; j < atoms.size(); ++j) {
+                if(atoms[i].Z != atoms[j].Z) continue;
+                double d2 = 0.0;
+                for(std::size_t k = 0; k < 3; ++k) {
+                    const auto dk = op.signs[k] * r[i][k] - r[j][k];
+                    d2 += dk * dk;
+                }
+                if(d2 < tol * tol) {
+                    atom_map[i] = j;
+                    is_symmetry = true;
+                    break;
+                }
+            }
+        }
+        if(is_symmetry) rv.push_back({op.name, op.signs, std::move(atom_map)});
+    }
+    return rv;
+}
+
+// Directions to, and bisecting pairs of, the smallest set of atoms sharing an
+// atomic number and a distance from the origin
+std::vector<vector_t> spherical_top_directions(
+  const std::vector<atom_data>& atoms, double tol) {
+    struct shell {
+        std::size_t Z;
+        double radius;
+        std::vector<vector_t> r;
+    };
+    std::vector<shell> shells;
+    for(const auto& atom : atoms) {
+        const auto radius = std::sqrt(dot(atom.r, atom.r));
+        if(radius < tol) continue;
+        auto itr = std::find_if(shells.begin(), shells.end(), [&](auto& s) {
+            return s.Z == atom.Z && std::abs(s.radius - radius) < tol;
+        });
+        if(itr == shells.end())
+            shells.push_back({atom.Z, radius, {atom.r}});
+        else
+            itr->r.push_back(atom.r);
+    }
+    if(shells.empty()) return {};
+
+    const auto& smallest = *std::min_element(
+      shells.begin(), shells.end(),
+      [](const auto& a, const auto& b) { return a.r.size() < b.r.size(); });
+
+    std::vector<vector_t> rv;
+    for(const auto& a : smallest.r) rv.push_back(normalize(a));
+    for(std::size_t i = 0; i < smallest.r.size(); ++i) {
+        for(std::size_t j = i + 1; j < smallest.r.size(); ++j) {
+            vector_t sum;
+            for(std::size_t k = 0; k < 3; ++k)
+                sum[k] = smallest.r[i][k] + smallest.r[j][k];
+            if(dot(sum, sum) > tol * tol) rv.push_back(normalize(sum));
+        }
+    }
+    return rv;
+}
+
+// The candidate frames: the principal axes, plus atom-aligned frames within
+// any degenerate subspace of the principal axes
+std::vector<matrix_t> candidate_frames(const std::vector<atom_data>& atoms,
+                                       double tol) {
+    matrix_t tensor{};
+    for(const auto& atom : atoms) {
+        const auto r2 = dot(atom.r, atom.r);
+        for(std::size_t p = 0; p < 3; ++p)
+            for(std::size_t q = 0; q < 3; ++q)
+                tensor[p][q] += atom.Z * ((p == q ? r2 : 0.0) -
+                                          atom.r[p] * atom.r[q]);
+    }
+    auto [values, vectors] = eigen_symmetric(tensor);
+    vectors[2]             = cross(vectors[0], vectors[1]);
+
+    std::vector<matrix_t> rv{vectors};
+    auto is_degenerate = [&](std::size_t p, std::size_t q) {
+        const auto scale = std::max({1.0, std::abs(values[p]),
+                                     std::abs(values[q])});
+        return std::abs(values[p] - values[q]) < tol * scale;
+    };
+
+    // Atoms far enough from an axis to define a direction
+    auto is_off_axis = [&](const vector_t& r, const vector_t& axis) {
+        const auto along = dot(r, axis);
+        return dot(r, r) - along * along > tol * tol;
+    };
+
+    const bool d01 = is_degenerate(0, 1), d02 = is_degenerate(0, 2),
+               d12 = is_degenerate(1, 2);
+    if(d01 && d02 && d12) {
+        // Spherical top: the C2 axes pass through atoms or bisect pairs of
+        // atoms of the smallest set of equivalent atoms, so try every
+        // orthogonal pair of those directions
+        auto directions = spherical_top_directions(atoms, tol);
+        for(const auto& z : directions)
+            for(const auto& x : directions)
+                if(std::abs(dot(z, x)) < tol) rv.push_back(frame_from(z, x));
+    } else if(d01 || d02 || d12) {
+        // Symmetric top: keep the unique axis, align x with each atom
+        const std::size_t unique = d01 ? 2 : (d02 ? 1 : 0);
+        const auto& z            = vectors[unique];
+        for(const auto& a : atoms)
+            if(is_off_axis(a.r, z)) rv.push_back(frame_from(z, a.r));
+    }
+    return rv;
+}
+
+std::string schoenflies_symbol(const std::vector<symmetry_operation>& ops) {
+    auto has = [&](const std::string& name) {
+        return std::any_of(ops.begin(), ops.end(),
+                           [&](const auto& op) { return op.name == name; });
+    };
+    const auto n_c2 = has("C2(x)") + has("C2(y)") + has("C2(z)");
+    switch(ops.size()) {
+        case 8: return "D2h";
+        case 4:
+            if(has("i")) return "C2h";
+            return n_c2 == 3 ? "D2" : "C2v";
+        case 2:
+            if(has("i")) return "Ci";
+            return n_c2 ? "C2" : "Cs";
+        default: return "C1";
+    }
+}
+
+// Permutes the frame axes so a unique C2 axis is z, or a lone mirror is xy
+matrix_t standard_orientation(const std::string& name,
+                              const std::vector<symmetry_operation>& ops,
+                              const matrix_t& frame) {
+    const bool has_unique_c2 = name == "C2" || name == "C2v" || name == "C2h";
+    if(!has_unique_c2 && name != "Cs") return frame;
+
+    // The C2 axis is the one it leaves alone, the mirror's normal is flipped
+    const std::string prefix = has_unique_c2 ? "C2" : "sigma";
+    const int sign           = has_unique_c2 ? 1 : -1;
+    for(const auto& op : ops) {
+        if(op.name.rfind(prefix, 0) != 0) continue;
+        std::size_t k = 0;
+        while(op.signs[k] != sign) ++k;
+        // Cyclic permutations keep the frame right-handed
+        if(k == 0) return {frame[1], frame[2], frame[0]};
+        if(k == 1) return {frame[2], frame[0], frame[1]};
+    }
+    return frame;
+}
+
+} // namespace
+
+point_group detect_point_group(const simde::type::chemical_system& sys,
+                               double tolerance) {
+    const auto& mol = sys.molecule();
+
+    point_group rv;
+    rv.origin = {0.0, 0.0, 0.0};
+    double total_charge = 0.0;
+    std::vector<atom_data> atoms;
+    for(std::size_t i = 0; i < mol.size(); ++i) {
+        const auto& atom = mol[i];
+        atoms.push_back({atom.Z(), {atom.x(), atom.y(), atom.z()}});
+        for(std::size_t k = 0; k < 3; ++k)
+            rv.origin[k] += atom.Z() * atoms.back().r[k];
+        total_charge += atom.Z();
+    }
+    if(total_charge > 0.0)
+        for(auto& x : rv.origin) x /= total_charge;
+    for(auto& atom : atoms)
+        for(std::size_t k = 0; k < 3; ++k) atom.r[k] -= rv.origin[k];
+
+    for(const auto& frame : candidate_frames(atoms, tolerance)) {
+        auto ops = find_operations(atoms, frame, tolerance);
+        if(ops.size() > rv.operations.size()) {
+            rv.axes       = frame;
+            rv.operations = std::move(ops);
+        }
+        if(rv.order() == d2h_operations.size()) break;
+    }
+
+    rv.name       = schoenflies_symbol(rv.operations);
+    rv.axes       = standard_orientation(rv.name, rv.operations, rv.axes);
+    rv.operations = find_operations(atoms, rv.axes, tolerance);
+    return rv;
+}
+
+} // namespace nwchemex
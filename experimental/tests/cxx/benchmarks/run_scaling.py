@@ -0,0 +1,176 @@
+# Copyright 2024 NWChemEx-Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+""" Strong-scaling sweep for the SCF, DF-SCF, and numerical gradient drivers.
+
+For every (driver, system, basis) in the ladder this runs the ``scaling``
+executable at each requested number of ranks and threads, and writes the
+collected records, augmented with speedup and parallel efficiency relative to
+the 1 rank/1 thread run, to a JSON file. Passing ``--compare`` with a previous
+output file reports every point whose efficiency dropped by more than
+``--tolerance`` and exits non-zero if there are any.
+
+"dfscf" runs need ``--fitting-basis``; density fitting with the orbital basis
+as the fitting basis would not time a meaningful calculation. Each run is
+killed after ``--timeout`` seconds (default one hour) and recorded as failed.
+
+Example::
+
+    python run_scaling.py --exe ./scaling --threads 1 2 4 8 --ranks 1 2 \\
+        --fitting-basis def2-universal-jkfit --output scaling.json
+
+See README.md in this directory for how to build ``scaling``.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+SYSTEMS = [
+    'water-1', 'water-2', 'water-4', 'water-8', 'alkane-2', 'alkane-4',
+    'alkane-8', 'glygly'
+]
+BASES = ['sto-3g', '6-31g', 'cc-pvdz', 'cc-pvtz']
+DRIVERS = ['scf', 'dfscf', 'gradient']
+
+
+def run_one(args, driver, system, basis, ranks, threads):
+    """ Runs the benchmark executable once and returns its JSON record, or a
+    record describing the failure.
+    """
+    cmd = [args.exe, driver, system, basis]
+    if driver == 'dfscf':
+        cmd.append(args.fitting_basis)
+    if ranks > 1 or args.always_launch:
+        cmd = [args.launcher, '-n', str(ranks)] + cmd
+
+    env = dict(os.environ)
+    env['MAD_NUM_THREADS'] = str(threads)
+    env['OMP_NUM_THREADS'] = '1'
+
+    failed = {
+        'driver': driver,
+        'system': system,
+        'basis': basis,
+        'ranks': ranks,
+        'threads': threads
+    }
+    try:
+        proc = subprocess.run(cmd,
+                              env=env,
+                              capture_output=True,
+                              text=True,
+                              timeout=args.timeout)
+    except subprocess.TimeoutExpired:
+        return dict(failed, error='timeout')
+
+    if proc.returncode != 0:
+        return dict(failed, error=proc.stderr.strip()[-500:])
+
+    for line in reversed(proc.stdout.splitlines()):
+        if line.startswith('{'):
+            record = json.loads(line)
+            record['threads'] = threads
+            return record
+    return dict(failed, error='no record in output')
+
+
+def add_efficiencies(records):
+    """ Adds speedup and parallel efficiency to each successful record.
+
+    Both are relative to the 1 rank/1 thread run of the same driver, system,
+    and basis. Points without a serial reference are left unannotated.
+    """
+    serial = {}
+    for r in records:
+        if 'error' not in r and r['ranks'] == 1 and r['threads'] == 1:
+            serial[(r['driver'], r['system'], r['basis'])] = r['time']
+
+    for r in records:
+        t1 = serial.get((r['driver'], r['system'], r['basis']))
+        if 'error' in r or t1 is None:
+            continue
+        workers = r['ranks'] * r['threads']
+        r['speedup'] = t1 / r['time']
+        r['efficiency'] = r['speedup'] / workers
+
+
+def find_regressions(records, reference, tolerance):
+    """ Returns (record, reference efficiency) for each point whose parallel
+    efficiency dropped by more than ``tolerance`` relative to ``reference``.
+    """
+
+    def key(r):
+        return (r['driver'], r['system'], r['basis'], r['ranks'],
+                r['threads'])
+
+    old = {key(r): r['efficiency'] for r in reference if 'efficiency' in r}
+    regressions = []
+    for r in records:
+        if 'efficiency' not in r or key(r) not in old:
+            continue
+        if old[key(r)] - r['efficiency'] > tolerance:
+            regressions.append((r, old[key(r)]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--exe', default='./scaling')
+    parser.add_argument('--launcher', default='mpiexec')
+    parser.add_argument('--always-launch', action='store_true')
+    parser.add_argument('--drivers', nargs='+', default=DRIVERS)
+    parser.add_argument('--systems', nargs='+', default=SYSTEMS)
+    parser.add_argument('--bases', nargs='+', default=BASES)
+    parser.add_argument('--fitting-basis', default=None)
+    parser.add_argument('--threads', nargs='+', type=int, default=[1])
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1])
+    parser.add_argument('--timeout', type=float, default=3600.0)
+    parser.add_argument('--output', default='scaling.json')
+    parser.add_argument('--compare', default=None)
+    parser.add_argument('--tolerance', type=float, default=0.1)
+    args = parser.parse_args()
+    if 'dfscf' in args.drivers and not args.fitting_basis:
+        parser.error('the dfscf driver requires --fitting-basis')
+
+    records = []
+    for driver in args.drivers:
+        for system in args.systems:
+            for basis in args.bases:
+                for ranks in args.ranks:
+                    for threads in args.threads:
+                        r = run_one(args, driver, system, basis, ranks,
+                                    threads)
+                        print(json.dumps(r), flush=True)
+                        records.append(r)
+
+    add_efficiencies(records)
+    with open(args.output, 'w') as f:
+        json.dump(records, f, indent=2)
+
+    if args.compare:
+        with open(args.compare) as f:
+            reference = json.load(f)
+        regressions = find_regressions(records, reference, args.tolerance)
+        for r, old in regressions:
+            print('Efficiency regression: {driver} {system}/{basis} at '
+                  '{ranks} ranks x {threads} threads: '.format(**r) +
+                  '{:.3f} -> {:.3f}'.format(old, r['efficiency']))
+        return 1 if regressions else 0
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
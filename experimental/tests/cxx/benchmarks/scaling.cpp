@@ -0,0 +1,231 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Times a single driver run for one (system, basis) pair and prints the
+ * result as a one-line JSON record on rank 0.
+ *
+ * Usage:
+ *   scaling <driver> <system> <basis> [<fitting basis>]
+ *
+ * where <driver> is one of "scf", "dfscf", or "gradient", and <system> is one
+ * of "water-<n>", "alkane-<n>", or "glygly". "dfscf" requires a fitting basis,
+ * e.g., a JK-fit set matching <basis>. The number of threads and ranks are
+ * whatever MADNESS was launched with; run_scaling.py sweeps over them and
+ * reduces the records into parallel efficiencies. Gradient runs do not report
+ * an energy. See README.md for how to build this.
+ */
+
+#include "nwchemex/nwchemex.hpp"
+#include "scf/property_types/derivative_types.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <sys/resource.h>
+#include <tiledarray.h>
+
+namespace {
+
+using energy_pt   = simde::AOEnergy;
+using gradient_pt = simde::AOEnergyNuclearGradient;
+using mol_bs_pt   = simde::MolecularBasisSet;
+using molecule_t  = simde::type::molecule;
+using atom_t      = simde::type::atom;
+
+constexpr double ang2bohr = 1.8897261246257702;
+
+atom_t make_atom(const std::string& sym, double x, double y, double z) {
+    if(sym == "H") return atom_t{"H", 1ul, 1837.15264648, x, y, z};
+    if(sym == "C") return atom_t{"C", 6ul, 21874.66, x, y, z};
+    if(sym == "N") return atom_t{"N", 7ul, 25526.04, x, y, z};
+    if(sym == "O") return atom_t{"O", 8ul, 29156.95, x, y, z};
+    throw std::runtime_error("Unsupported element: " + sym);
+}
+
+void push_back_ang(molecule_t& mol, const std::string& sym, double x, double y,
+                   double z) {
+    mol.push_back(make_atom(sym, x * ang2bohr, y * ang2bohr, z * ang2bohr));
+}
+
+// n water molecules on a cubic grid with 2.9 Angstrom spacing
+molecule_t water_cluster(std::size_t n) {
+    const auto side = static_cast<std::size_t>(std::ceil(std::cbrt(n)));
+    const double d  = 2.9;
+    molecule_t mol;
+    for(std::size_t i = 0; i < n; ++i) {
+        const double x = d * (i % side);
+        const double y = d * ((i / side) % side);
+        const double z = d * (i / (side * side));
+        push_back_ang(mol, "O", x, y, z);
+        push_back_ang(mol, "H", x + 0.757, y + 0.586, z);
+        push_back_ang(mol, "H", x - 0.757, y + 0.586, z);
+    }
+    return mol;
+}
+
+// All-trans C_nH_{2n+2} zig-zag chain in the xy-plane
+molecule_t alkane(std::size_t n) {
+    if(n < 2) throw std::runtime_error("alkane-<n> requires n >= 2");
+    const double dx = 1.255, dy = 0.89, hy = 0.63, hz = 0.89;
+    molecule_t mol;
+    for(std::size_t i = 0; i < n; ++i) {
+        const double x    = dx * i;
+        const bool up     = i % 2;
+        const double y    = up ? dy : 0.0;
+        const double hoff = up ? hy : -hy;
+        push_back_ang(mol, "C", x, y, 0.0);
+        push_back_ang(mol, "H", x, y + hoff, hz);
+        push_back_ang(mol, "H", x, y + hoff, -hz);
+        if(i == 0) push_back_ang(mol, "H", x - 1.03, y + 0.36, 0.0);
+        if(i == n - 1) {
+            push_back_ang(mol, "H", x + 1.03, y + (up ? -0.36 : 0.36), 0.0);
+        }
+    }
+    return mol;
+}
+
+// Extended glycylglycine, approximate geometry
+molecule_t glygly() {
+    molecule_t mol;
+    push_back_ang(mol, "N", -2.95, 0.35, 0.00);
+    push_back_ang(mol, "H", -3.80, -0.15, 0.00);
+    push_back_ang(mol, "H", -3.00, 1.03, 0.70);
+    push_back_ang(mol, "C", -1.70, -0.40, 0.00);
+    push_back_ang(mol, "H", -1.70, -1.05, 0.89);
+    push_back_ang(mol, "H", -1.70, -1.05, -0.89);
+    push_back_ang(mol, "C", -0.45, 0.45, 0.00);
+    push_back_ang(mol, "O", -0.45, 1.68, 0.00);
+    push_back_ang(mol, "N", 0.70, -0.25, 0.00);
+    push_back_ang(mol, "H", 0.70, -1.26, 0.00);
+    push_back_ang(mol, "C", 1.98, 0.42, 0.00);
+    push_back_ang(mol, "H", 1.98, 1.07, 0.89);
+    push_back_ang(mol, "H", 1.98, 1.07, -0.89);
+    push_back_ang(mol, "C", 3.18, -0.48, 0.00);
+    push_back_ang(mol, "O", 3.15, -1.70, 0.00);
+    push_back_ang(mol, "O", 4.33, 0.22, 0.00);
+    push_back_ang(mol, "H", 5.08, -0.40, 0.00);
+    return mol;
+}
+
+molecule_t make_system(const std::string& name) {
+    if(name == "glygly") return glygly();
+    const auto dash   = name.find('-');
+    const auto kind   = name.substr(0, dash);
+    const auto digits = dash == std::string::npos ? "" : name.substr(dash + 1);
+    const bool is_count =
+      !digits.empty() && digits.size() < 10 &&
+      std::all_of(digits.begin(), digits.end(),
+                  [](unsigned char c) { return std::isdigit(c); });
+    if(!is_count) throw std::runtime_error("Unknown system: " + name);
+    const auto n = std::stoul(digits);
+    if(kind == "water" && n > 0) return water_cluster(n);
+    if(kind == "alkane") return alkane(n);
+    throw std::runtime_error("Unknown system: " + name);
+}
+
+// Peak resident set size of this process in bytes
+long peak_rss() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss * 1024l;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto& world = TA::initialize(argc, argv);
+
+    auto usage_error = [&](const std::string& msg) {
+        if(world.rank() == 0)
+            std::cerr << msg << "\nUsage: " << argv[0]
+                      << " <scf|dfscf|gradient> <water-<n>|alkane-<n>|glygly> "
+                         "<basis> [<fitting basis>]"
+                      << std::endl;
+        TA::finalize();
+        return 1;
+    };
+
+    if(argc < 4) return usage_error("Too few arguments");
+
+    const std::string driver{argv[1]};
+    const std::string system{argv[2]};
+    const std::string basis{argv[3]};
+    const std::string fitting_basis{argc > 4 ? argv[4] : ""};
+
+    if(driver != "scf" && driver != "dfscf" && driver != "gradient")
+        return usage_error("Unknown driver: " + driver);
+    if(driver == "dfscf" && fitting_basis.empty())
+        return usage_error("dfscf requires a fitting basis");
+
+    molecule_t mol;
+    try {
+        mol = make_system(system);
+    } catch(const std::runtime_error& e) { return usage_error(e.what()); }
+
+    pluginplay::ModuleManager mm;
+    nwchemex::load_modules(mm);
+
+    auto bs  = mm.at(basis).run_as<mol_bs_pt>(mol);
+    simde::type::ao_space aos(bs);
+    simde::type::chemical_system chem_sys(mol);
+
+    if(driver == "dfscf") {
+        auto aux_bs = mm.at(fitting_basis).run_as<mol_bs_pt>(mol);
+        simde::type::ao_space aux_aos(aux_bs);
+        mm.change_input("DFJK", "Fitting Basis", aux_aos);
+        mm.change_submod("Fock Matrix", "J Builder", "DFJK");
+        mm.change_submod("Fock Matrix", "K Builder", "DFJK");
+    }
+
+    world.gop.fence();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::optional<double> energy;
+    if(driver == "gradient") {
+        mm.at("SCF Numerical Gradient").run_as<gradient_pt>(aos, chem_sys, mol);
+    } else {
+        energy = mm.at("SCF Energy").run_as<energy_pt>(aos, chem_sys);
+    }
+
+    world.gop.fence();
+    auto stop = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> seconds = stop - start;
+
+    long rss = peak_rss();
+    world.gop.max(rss);
+
+    if(world.rank() == 0) {
+        std::cout << std::setprecision(12);
+        std::cout << "{\"driver\": \"" << driver << "\", \"system\": \""
+                  << system << "\", \"basis\": \"" << basis
+                  << "\", \"n_atoms\": " << mol.size()
+                  << ", \"n_aos\": " << aos.basis_set().n_aos()
+                  << ", \"ranks\": " << world.size()
+                  << ", \"threads\": " << madness::ThreadPool::size() + 1
+                  << ", \"time\": " << seconds.count()
+                  << ", \"peak_memory\": " << rss;
+        if(energy) std::cout << ", \"energy\": " << *energy;
+        std::cout << "}" << std::endl;
+    }
+
+    TA::finalize();
+    return 0;
+}
@@ -16,6 +16,7 @@
 
 #include "nwchemex/nwchemex.hpp"
 #include <catch2/catch.hpp>
+#include <limits>
 
 using pt        = simde::AOEnergy;
 using mol_bs_pt = simde::MolecularBasisSet;
@@ -45,3 +46,55 @@ TEST_CASE("DF-SCF") {
     std::cout << "Total DF-SCF/STO-3G Energy: " << E << std::endl;
     REQUIRE(E == Approx(-1.16282097647378).margin(1.0e-8));
 }
+
+TEST_CASE("J/K selected by memory budget") {
+    pluginplay::ModuleManager mm;
+    nwchemex::load_modules(mm);
+
+    simde::type::atom H1{"H", 1ul, 0.0, 0.0, 0.0, 0.0};
+    simde::type::atom H2{"H", 1ul, 0.0, 0.0, 0.0, 1.6818473865225443};
+    simde::type::molecule mol{H1, H2};
+    auto bs     = mm.at("sto-3g").run_as<mol_bs_pt>(mol);
+    auto aux_bs = mm.at("sto-3g").run_as<mol_bs_pt>(mol);
+
+    simde::type::ao_space aos(bs);
+    simde::type::ao_space aux_aos(aux_bs);
+    simde::type::chemical_system chem_sys(mol);
+
+    // 2 AOs: in-core needs 256 bytes, density-fitted needs 224 bytes
+    REQUIRE(nwchemex::in_core_jk_memory(2) == 256);
+    REQUIRE(nwchemex::density_fitted_jk_memory(2, 2) == 224);
+
+    // Estimates that do not fit in std::size_t clamp instead of wrapping
+    constexpr auto max_bytes = std::numeric_limits<std::size_t>::max();
+    REQUIRE(nwchemex::in_core_jk_memory(100000) == max_bytes);
+    REQUIRE(nwchemex::density_fitted_jk_memory(1ul << 22, 1ul << 24) ==
+            max_bytes);
+
+    SECTION("Budget fits in-core") {
+        REQUIRE(nwchemex::select_jk_algorithm(mm, aos, 256, true) == "CanJK");
+    }
+
+    SECTION("Density fitting is opt-in") {
+        REQUIRE_THROWS_AS(nwchemex::select_jk_algorithm(mm, aos, 240),
+                          std::runtime_error);
+    }
+
+    SECTION("Density fitting needs a fitting basis") {
+        REQUIRE_THROWS_AS(nwchemex::select_jk_algorithm(mm, aos, 240, true),
+                          std::runtime_error);
+    }
+
+    SECTION("Budget only fits density fitting") {
+        mm.change_input("DFJK", "Fitting Basis", aux_aos);
+        REQUIRE(nwchemex::select_jk_algorithm(mm, aos, 240, true) == "DFJK");
+        auto E = mm.at("SCF Energy").run_as<pt>(aos, chem_sys);
+        REQUIRE(E == Approx(-1.16282097647378).margin(1.0e-8));
+    }
+
+    SECTION("Budget fits nothing") {
+        mm.change_input("DFJK", "Fitting Basis", aux_aos);
+        REQUIRE_THROWS_AS(nwchemex::select_jk_algorithm(mm, aos, 100, true),
+                          std::runtime_error);
+    }
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nwchemex/nwchemex.hpp"
+#include "nwchemex/point_group.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+
+using simde::type::chemical_system;
+using molecule_pt = simde::MoleculeFromString;
+
+namespace {
+
+const double pi = std::acos(-1.0);
+
+// An atom at distance r from the z axis, at angle theta from the x axis
+simde::type::atom ring_atom(const std::string& symbol, std::size_t Z,
+                            double r, double theta, double z) {
+    return simde::type::atom{symbol, Z, 0.0, r * std::cos(theta),
+                             r * std::sin(theta), z};
+}
+
+} // namespace
+
+TEST_CASE("detect_point_group") {
+    SECTION("Water") {
+        pluginplay::ModuleManager mm;
+        nwchemex::load_modules(mm);
+        std::string name{"water"};
+        auto mol = mm.at("NWX Molecules").run_as<molecule_pt>(name);
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "C2v");
+        REQUIRE(pg.order() == 4);
+        REQUIRE(pg.operations[0].name == "E");
+
+        // C2 about z swaps the hydrogens and leaves the oxygen alone
+        const auto& c2 = pg.operations[1];
+        REQUIRE(c2.name == "C2(z)");
+        std::size_t n_fixed = 0;
+        for(std::size_t i = 0; i < c2.atom_map.size(); ++i)
+            n_fixed += (c2.atom_map[i] == i);
+        REQUIRE(n_fixed == 1);
+    }
+
+    SECTION("H2") {
+        simde::type::atom H1{"H", 1ul, 0.0, 0.0, 0.0, 0.0};
+        simde::type::atom H2{"H", 1ul, 0.0, 0.0, 0.0, 1.6818473865225443};
+        simde::type::molecule mol{H1, H2};
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "D2h");
+        REQUIRE(pg.order() == 8);
+    }
+
+    SECTION("HHe+ is linear but not centrosymmetric") {
+        simde::type::atom H{"H", 1ul, 0.0, 0.0, 0.0, 0.0};
+        simde::type::atom He{"He", 2ul, 0.0, 0.0, 0.0, 1.46};
+        simde::type::molecule mol{H, He};
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol, 2});
+        REQUIRE(pg.name == "C2v");
+    }
+
+    SECTION("No symmetry") {
+        simde::type::atom H{"H", 1ul, 0.0, 0.0, 0.0, 0.0};
+        simde::type::atom O{"O", 8ul, 0.0, 1.8, 0.0, 0.0};
+        simde::type::atom N{"N", 7ul, 0.0, 0.3, 1.7, 0.2};
+        simde::type::atom C{"C", 6ul, 0.0, -0.4, 0.6, 2.1};
+        simde::type::molecule mol{H, O, N, C};
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "C1");
+        REQUIRE(pg.order() == 1);
+    }
+
+    SECTION("Benzene (symmetric top, D6h)") {
+        simde::type::molecule mol;
+        for(std::size_t i = 0; i < 6; ++i) {
+            mol.push_back(ring_atom("C", 6ul, 2.64, i * pi / 3.0, 0.0));
+            mol.push_back(ring_atom("H", 1ul, 4.69, i * pi / 3.0, 0.0));
+        }
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "D2h");
+    }
+
+    SECTION("Ammonia (symmetric top, C3v)") {
+        simde::type::molecule mol{simde::type::atom{"N", 7ul, 0.0, 0.0, 0.0,
+                                                    0.72}};
+        for(std::size_t i = 0; i < 3; ++i)
+            mol.push_back(ring_atom("H", 1ul, 1.77, i * 2.0 * pi / 3.0, 0.0));
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "Cs");
+        REQUIRE(pg.order() == 2);
+    }
+
+    SECTION("Methane (spherical top, Td)") {
+        const double a = 1.19;
+        simde::type::atom C{"C", 6ul, 0.0, 0.0, 0.0, 0.0};
+        simde::type::atom H1{"H", 1ul, 0.0, a, a, a};
+        simde::type::atom H2{"H", 1ul, 0.0, -a, -a, a};
+        simde::type::atom H3{"H", 1ul, 0.0, -a, a, -a};
+        simde::type::atom H4{"H", 1ul, 0.0, a, -a, -a};
+        simde::type::molecule mol{C, H1, H2, H3, H4};
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "D2");
+        REQUIRE(pg.order() == 4);
+    }
+
+    SECTION("SF6 (spherical top, Oh)") {
+        const double r = 2.95;
+        simde::type::molecule mol{simde::type::atom{"S", 16ul, 0.0, 0.0, 0.0,
+                                                    0.0}};
+        for(double sign : {1.0, -1.0}) {
+            mol.push_back(simde::type::atom{"F", 9ul, 0.0, sign * r, 0.0, 0.0});
+            mol.push_back(simde::type::atom{"F", 9ul, 0.0, 0.0, sign * r, 0.0});
+            mol.push_back(simde::type::atom{"F", 9ul, 0.0, 0.0, 0.0, sign * r});
+        }
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "D2h");
+    }
+
+    SECTION("Allene (symmetric top, D2d)") {
+        // The CH2 groups lie in perpendicular planes containing the C=C=C axis
+        simde::type::atom C1{"C", 6ul, 0.0, 0.0, 0.0, -2.48};
+        simde::type::atom C2{"C", 6ul, 0.0, 0.0, 0.0, 0.0};
+        simde::type::atom C3{"C", 6ul, 0.0, 0.0, 0.0, 2.48};
+        simde::type::atom H1{"H", 1ul, 0.0, 1.75, 0.0, -3.50};
+        simde::type::atom H2{"H", 1ul, 0.0, -1.75, 0.0, -3.50};
+        simde::type::atom H3{"H", 1ul, 0.0, 0.0, 1.75, 3.50};
+        simde::type::atom H4{"H", 1ul, 0.0, 0.0, -1.75, 3.50};
+        simde::type::molecule mol{C1, C2, C3, H1, H2, H3, H4};
+
+        auto pg = nwchemex::detect_point_group(chemical_system{mol});
+        REQUIRE(pg.name == "C2v");
+        REQUIRE(pg.order() == 4);
+    }
+}
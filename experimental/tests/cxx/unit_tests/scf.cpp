@@ -63,8 +63,7 @@ TEST_CASE("SCF with SAD guess") {
     simde::type::chemical_system chem_sys(mol);
 
     // Use SAD guess
-    mm.change_submod("SADDensity", "Atomic Density", "sto-3g atomic dm");
-    mm.change_submod("SCF Wavefunction", "Guess", "SADGuess");
+    nwchemex::use_sad_guess(mm, "sto-3g");
 
     // Calculate energy
     auto E = mm.at("SCF Energy").run_as<pt>(aos, chem_sys);
@@ -79,3 +78,23 @@ TEST_CASE("SCF with SAD guess") {
     std::cout << "Time taken by SCF Test with SAD Guess: " << duration.count()
               << " microseconds" << std::endl;
 }
+
+TEST_CASE("use_sad_guess") {
+    pluginplay::ModuleManager mm;
+    nwchemex::load_modules(mm);
+
+    // The core guess is the default
+    const auto& sad = mm.at("SADGuess");
+    REQUIRE(mm.at("SCF Wavefunction").submods().at("Guess").value() != sad);
+    REQUIRE(mm.at("SCF Density Driver").submods().at("Guess").value() != sad);
+
+    // ChemCache only has atomic densities for STO-3G
+    nwchemex::use_sad_guess(mm, "sto-3g");
+    REQUIRE(mm.at("SCF Wavefunction").submods().at("Guess").value() == sad);
+    REQUIRE(mm.at("SCF Density Driver").submods().at("Guess").value() == sad);
+    REQUIRE(mm.at("SADDensity").submods().at("Atomic Density").value() ==
+            mm.at("sto-3g atomic dm"));
+
+    REQUIRE_THROWS_AS(nwchemex::use_sad_guess(mm, "not a basis"),
+                      std::out_of_range);
+}
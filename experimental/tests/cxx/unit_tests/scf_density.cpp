@@ -63,8 +63,7 @@ TEST_CASE("Density-based SCF with SAD guess") {
     simde::type::chemical_system chem_sys(mol);
 
     // Use SAD guess
-    mm.change_submod("SADDensity", "Atomic Density", "sto-3g atomic dm");
-    mm.change_submod("SCF Density Driver", "Guess", "SADGuess");
+    nwchemex::use_sad_guess(mm, "sto-3g");
 
     // Calculate energy
     auto E = mm.at("SCF Energy From Density").run_as<pt>(aos, chem_sys);
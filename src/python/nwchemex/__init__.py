@@ -13,4 +13,5 @@
 # limitations under the License.
 
 from .compute_energy import *
+from .compute_properties import *
 from .load_modules import *
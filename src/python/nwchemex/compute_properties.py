@@ -0,0 +1,114 @@
+# Copyright 2024 NWChemEx Community
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from .load_modules import load_modules
+import chemist
+import numpy
+import pluginplay
+import simde
+
+
+def _nuclear_positions(sys):
+    """ The positions of ``sys``'s nuclei, as the points to differentiate
+    with respect to.
+    """
+    mol = sys.molecule
+    points = chemist.PointSetD()
+    for i in range(mol.size()):
+        atom = mol.at(i)
+        points.push_back(chemist.PointD(atom.x, atom.y, atom.z))
+    return points
+
+
+def _run(mm, method, sys, properties):
+    """ Runs ``method`` once, as the property type whose results include every
+    requested property.
+
+    A module that computes gradients also returns its energy, so a request
+    for both is a single gradient run.
+    """
+    mod = mm.at(method)
+    if 'gradient' in properties:
+        pt = simde.EnergyNuclearGradientStdVectorD()
+        inputs = pt.wrap_inputs(mod.inputs(), sys, _nuclear_positions(sys))
+    else:
+        pt = simde.TotalEnergy()
+        inputs = pt.wrap_inputs(mod.inputs(), sys)
+    return mod.run(inputs)
+
+
+def _energy(results):
+    energy, = simde.TotalEnergy().unwrap_results(results)
+    return energy
+
+
+def _gradient(results):
+    grad, = simde.EnergyNuclearGradientStdVectorD().unwrap_results(results)
+    return numpy.array(grad, dtype=numpy.float64).reshape(-1, 3)
+
+
+# Maps each property compute_properties knows about to how to extract it
+_properties = {'energy': _energy, 'gradient': _gradient}
+
+
+def compute_properties(mol, method, basis, properties=('energy', ), mm=None):
+    """ Computes several properties of a system in one call.
+
+    ``method`` is run once, however many properties are requested, and each
+    property is taken from that run's results. There is no zero-copy path
+    yet: the gradient comes back from the bindings as a Python list and is
+    copied element by element into a NumPy array. Densities and molecular
+    orbitals are not available yet.
+
+    :param mol: The system, or the name of a molecule known to ChemCache.
+    :type mol: chemist.ChemicalSystem or str
+    :param method: The key of the module to compute the properties with.
+    :type method: str
+    :param basis: The name of the basis set.
+    :type basis: str
+    :param properties: Which properties to compute, or the name of a single
+        property. Supported properties are ``'energy'`` (a float) and
+        ``'gradient'`` (an array with one row per atom). Defaults to
+        ``('energy',)``.
+    :type properties: str or iterable of str
+    :param mm: The ModuleManager to use. Defaults to a new one with NWChemEx's
+        modules loaded.
+    :type mm: pluginplay.ModuleManager
+
+    :return: The requested properties, keyed by name.
+    :rtype: dict
+
+    :raises ValueError: If any requested property is not supported.
+    """
+
+    if isinstance(properties, str):
+        properties = (properties, )
+
+    unknown = [p for p in properties if p not in _properties]
+    if unknown:
+        raise ValueError('Unsupported properties: {}. Supported: {}'.format(
+            ', '.join(unknown), ', '.join(_properties)))
+
+    if not mm:
+        mm = pluginplay.ModuleManager()
+        load_modules(mm)
+
+    if type(mol) == str:
+        mol = mm.run_as(simde.MoleculeFromString(), 'NWX Molecules', mol)
+        mol = chemist.ChemicalSystem(mol)
+
+    mm.change_input(method, 'basis set', basis)
+
+    results = _run(mm, method, mol, properties)
+    return {p: _properties[p](results) for p in properties}
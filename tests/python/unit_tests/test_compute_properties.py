@@ -0,0 +1,75 @@
+# Copyright 2024 NWChemEx-Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import unittest
+from nwchemex import compute_properties
+from pluginplay import ModuleBase, ModuleManager
+from simde import TotalEnergy, EnergyNuclearGradientStdVectorD
+from chemist import ChemicalSystem
+
+
+class DummyPropertiesModule(ModuleBase):
+
+    def __init__(self):
+        ModuleBase.__init__(self)
+        self.satisfies_property_type(TotalEnergy())
+        self.satisfies_property_type(EnergyNuclearGradientStdVectorD())
+        self.add_input('basis set')
+        self.n_runs = 0
+
+    def run_(self, inputs, submods):
+        self.n_runs += 1
+        rv = self.results()
+        rv = TotalEnergy().wrap_results(rv, -3.14)
+        grad = [0.1, 0.2, 0.3, -0.1, -0.2, -0.3]
+        return EnergyNuclearGradientStdVectorD().wrap_results(rv, grad)
+
+
+class TestComputeProperties(unittest.TestCase):
+
+    def setUp(self):
+        self.mm = ModuleManager()
+        self.dummy = DummyPropertiesModule()
+        self.mm.add_module('Dummy', self.dummy)
+
+    def test_energy_and_gradient(self):
+        props = compute_properties(ChemicalSystem(), 'Dummy', 'sto-3g',
+                                   ('energy', 'gradient'), self.mm)
+        self.assertAlmostEqual(props['energy'], -3.14, places=5)
+        self.assertEqual(props['gradient'].shape, (2, 3))
+        self.assertAlmostEqual(props['gradient'][1, 2], -0.3, places=5)
+
+    def test_runs_method_once(self):
+        compute_properties(ChemicalSystem(), 'Dummy', 'sto-3g',
+                           ('energy', 'gradient'), self.mm)
+        self.assertEqual(self.dummy.n_runs, 1)
+
+    def test_only_requested_properties(self):
+        props = compute_properties(ChemicalSystem(), 'Dummy', 'sto-3g',
+                                   mm=self.mm)
+        self.assertEqual(list(props), ['energy'])
+
+    def test_unknown_property(self):
+        with self.assertRaises(ValueError):
+            compute_properties(ChemicalSystem(), 'Dummy', 'sto-3g',
+                               ('energy', 'not a property'), self.mm)
+
+    def test_single_property_string(self):
+        props = compute_properties(ChemicalSystem(), 'Dummy', 'sto-3g',
+                                   'gradient', self.mm)
+        self.assertEqual(list(props), ['gradient'])
+
+    def test_with_string_molecule(self):
+        props = compute_properties('water', 'NWChem : SCF', 'sto-3g')
+        self.assertAlmostEqual(props['energy'], -74.942080058523, places=5)